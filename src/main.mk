@@ -53,8 +53,14 @@ SOURCES      := \
                 kmers-v1/kmers.C \
                 \
                 kmers-v2/kmers-exact.C \
+                kmers-v2/kmers-approx.C \
+                kmers-v2/kmers-filter.C \
                 kmers-v2/kmers-files.C \
                 kmers-v2/kmers-histogram.C \
+                kmers-v2/kmers-large.C \
+                kmers-v2/kmers-counter.C \
+                kmers-v2/kmers-counttable.C \
+                kmers-v2/kmers-merge.C \
                 kmers-v2/kmers-reader-dump.C \
                 kmers-v2/kmers-reader.C \
                 kmers-v2/kmers-writer-block.C \
@@ -78,6 +84,7 @@ SOURCES      := \
                 sequence/dnaSeq-v1.C \
                 sequence/dnaSeqFile-v1.C \
                 sequence/sequence-v1.C \
+                sequence/sequence-v1-acgt.C \
                 \
                 htslib/hts/bcf_sr_sort.c \
                 htslib/hts/bgzf.c \
@@ -176,6 +183,8 @@ SUBMAKEFILES += tests/alignTest-ssw.mk \
                 tests/count-palindromes.mk \
                 tests/loggingTest.mk \
                 tests/magicNumber.mk \
+                tests/kmerIteratorTest.mk \
+                tests/merylLookupTest.mk \
                 tests/parasailTest.mk \
                 tests/testVectorSupport.mk \
                 tests/readLines.mk \
@@ -4,5 +4,5 @@ SOURCES  := pccp.C
 SRC_INCDIRS := .. ../utility
 
 TGT_LDFLAGS := -L${TARGET_DIR}/lib
-TGT_LDLIBS  := -l${MODULE}
+TGT_LDLIBS  := -l${MODULE} -lz -llzma -lbz2
 TGT_PREREQS := lib${MODULE}.a
@@ -4,5 +4,5 @@ SOURCES  := alignTest-ksw2.C
 SRC_INCDIRS := .. ../utility
 
 TGT_LDFLAGS := -L${TARGET_DIR}/lib
-TGT_LDLIBS  := -l${MODULE}
+TGT_LDLIBS  := -l${MODULE} -lz -llzma -lbz2
 TGT_PREREQS := lib${MODULE}.a
@@ -0,0 +1,8 @@
+TARGET   := kmerIteratorTest
+SOURCES  := kmerIteratorTest.C
+
+SRC_INCDIRS := .. ../utility
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE} -lz -llzma -lbz2
+TGT_PREREQS := lib${MODULE}.a
@@ -0,0 +1,8 @@
+TARGET   := merylLookupTest
+SOURCES  := merylLookupTest.C
+
+SRC_INCDIRS := .. ../utility
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE} -lz -llzma -lbz2
+TGT_PREREQS := lib${MODULE}.a
@@ -6,5 +6,5 @@ SRC_INCDIRS := .. ../utility ../parasail
 
 #TGT_LDFLAGS := -L${TARGET_DIR}/lib -L/work/software/parasail/.libs -lparasail
 TGT_LDFLAGS := -L${TARGET_DIR}/lib
-TGT_LDLIBS  := -l${MODULE}
+TGT_LDLIBS  := -l${MODULE} -lz -llzma -lbz2
 TGT_PREREQS := lib${MODULE}.a
@@ -5,5 +5,5 @@ SRC_INCDIRS := .. ../utility
 
 TGT_CXXFLAGS:= -mxsave
 TGT_LDFLAGS := -L${TARGET_DIR}/lib
-TGT_LDLIBS  := -l${MODULE}
+TGT_LDLIBS  := -l${MODULE} -lz -llzma -lbz2
 TGT_PREREQS := lib${MODULE}.a